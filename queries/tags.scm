@@ -0,0 +1,11 @@
+(message
+  id: (identifier) @name) @definition.message
+
+(term
+  id: (term_identifier) @name) @definition.term
+
+(message_reference
+  id: (identifier) @name) @reference.message
+
+(term_reference
+  id: (term_identifier) @name) @reference.term
@@ -314,7 +314,7 @@ bool tree_sitter_fluent_external_scanner_scan(void *payload, TSLexer *lexer,
   if (valid_symbols[UNFINISHED_LINE] &&
       s->in_pattern >= FLUENT_MAX_NESTED_PATTERNS) {
     FLUENT_DEBUG("start UNFINISHED_LINE")
-    while (lexer->lookahead != '\n') {
+    while (lexer->lookahead != '\n' && lexer->lookahead != 0) {
       lexer->advance(lexer, false);
     }
     lexer->advance(lexer, false);